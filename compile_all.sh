@@ -10,7 +10,7 @@ emcc src/text_filter_simple.cpp \
   -I src/ \
   -O2 \
   -s WASM=1 \
-  -s EXPORTED_FUNCTIONS='["_init_text_filter", "_load_bad_words", "_check_text", "_check_text_with_detail", "_add_bad_word", "_remove_bad_word", "_clear_bad_words", "_get_bad_words_count", "_cleanup_text_filter", "_malloc", "_free"]' \
+  -s EXPORTED_FUNCTIONS='["_init_text_filter", "_load_bad_words", "_check_text", "_check_text_with_detail", "_check_text_with_score", "_add_bad_word", "_remove_bad_word", "_clear_bad_words", "_get_bad_words_count", "_cleanup_text_filter", "_set_text_cache_capacity", "_clear_text_cache", "_get_text_cache_hits", "_get_text_cache_misses", "_malloc", "_free"]' \
   -s EXPORTED_RUNTIME_METHODS='["cwrap", "UTF8ToString", "stringToUTF8"]' \
   -o build/text_filter.js
 
@@ -28,7 +28,7 @@ emcc src/content_moderator.cpp \
   -s EXPORT_NAME='ContentModeratorModule' \
   -s USE_ES6_IMPORT_META=0 \
   -s ALLOW_MEMORY_GROWTH=1 \
-  -s EXPORTED_FUNCTIONS='["_init_moderator", "_analyze_image", "_analyze_image_with_sensitivity", "_cleanup_moderator", "_malloc", "_free"]' \
+  -s EXPORTED_FUNCTIONS='["_init_moderator", "_analyze_image", "_analyze_image_with_sensitivity", "_cleanup_moderator", "_set_image_cache_capacity", "_clear_image_cache", "_get_image_cache_hits", "_get_image_cache_misses", "_malloc", "_free"]' \
   -s EXPORTED_RUNTIME_METHODS='["ccall", "cwrap"]' \
   --closure 0 \
   -o build/content_moderator.js
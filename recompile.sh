@@ -10,7 +10,7 @@ emcc src/text_filter_simple.cpp \
   -I src/ \
   -O2 \
   -s WASM=1 \
-  -s EXPORTED_FUNCTIONS='["_init_text_filter", "_load_bad_words", "_check_text", "_check_text_with_detail", "_add_bad_word", "_remove_bad_word", "_clear_bad_words", "_get_bad_words_count", "_cleanup_text_filter", "_malloc", "_free"]' \
+  -s EXPORTED_FUNCTIONS='["_init_text_filter", "_load_bad_words", "_check_text", "_check_text_with_detail", "_check_text_with_score", "_add_bad_word", "_remove_bad_word", "_clear_bad_words", "_get_bad_words_count", "_cleanup_text_filter", "_set_text_cache_capacity", "_clear_text_cache", "_get_text_cache_hits", "_get_text_cache_misses", "_malloc", "_free"]' \
   -s EXPORTED_RUNTIME_METHODS='["cwrap", "UTF8ToString", "stringToUTF8"]' \
   -o build/text_filter.js
 
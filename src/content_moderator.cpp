@@ -1,4 +1,5 @@
 #include "content_moderator.hpp"
+#include "result_cache.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -11,6 +12,22 @@ struct ModeratorConfig {
     int min_skin_region_size = 50;
 } config;
 
+// Параметры запроса и второй хеш пикселей, хранятся в записи кэша
+struct ImageCheck {
+    int width = 0;
+    int height = 0;
+    int sensitivity = 0;
+    uint64_t pixels_hash = 0;
+
+    bool operator==(const ImageCheck& other) const {
+        return width == other.width && height == other.height &&
+               sensitivity == other.sensitivity && pixels_hash == other.pixels_hash;
+    }
+};
+
+// Кэш оценок для повторяющихся изображений (аватары, репосты)
+ResultCache<ImageCheck, int> image_cache(64);
+
 bool is_skin_tone(uint8_t r, uint8_t g, uint8_t b) {
     float red = r / 255.0f;
     float green = g / 255.0f;
@@ -69,6 +86,7 @@ void analyze_region(const uint8_t* image_data, int width, int height,
 
 void init_moderator() {
     config = ModeratorConfig();
+    image_cache.clear();
 }
 
 int analyze_image(const uint8_t* image_data, int width, int height) {
@@ -80,6 +98,26 @@ int analyze_image_with_sensitivity(const uint8_t* image_data, int width, int hei
         return 0;
     }
 
+    uint64_t key = 0;
+    ImageCheck check;
+
+    if (image_cache.enabled()) {
+        size_t size = static_cast<size_t>(width) * height * 4;
+        const int32_t params[3] = { width, height, sensitivity };
+        HashPair hash = hash_bytes2(image_data, size, hash_bytes(params, sizeof(params)));
+        key = hash.key;
+
+        check.width = width;
+        check.height = height;
+        check.sensitivity = sensitivity;
+        check.pixels_hash = hash.check;
+
+        int cached = 0;
+        if (image_cache.get(key, check, cached)) {
+            return cached;
+        }
+    }
+
     float sensitivity_factor = sensitivity / 100.0f;
     float adaptive_skin_threshold = config.skin_tone_threshold * (1.0f + sensitivity_factor);
     float adaptive_saturation_threshold = config.saturation_threshold * (1.0f + sensitivity_factor);
@@ -138,11 +176,33 @@ int analyze_image_with_sensitivity(const uint8_t* image_data, int width, int hei
     nsfw_score *= (1.0f - sensitivity_factor * 0.5f);
 
     int result = static_cast<int>(std::min(nsfw_score * 100.0f, 100.0f));
-    return std::max(0, result);
+    result = std::max(0, result);
+
+    image_cache.put(key, check, result);
+    return result;
 }
 
 void cleanup_moderator() {
     // Очистка ресурсов (если используются динамические модели)
+    image_cache.clear();
+    image_cache.reset_stats();
+}
+
+void set_image_cache_capacity(int capacity) {
+    image_cache.set_capacity(static_cast<size_t>(std::max(0, capacity)));
+}
+
+void clear_image_cache() {
+    image_cache.clear();
+    image_cache.reset_stats();
+}
+
+double get_image_cache_hits() {
+    return static_cast<double>(image_cache.hits());
+}
+
+double get_image_cache_misses() {
+    return static_cast<double>(image_cache.misses());
 }
 
 float get_region_brightness(const uint8_t* image_data, int width, int height,
@@ -15,6 +15,14 @@ int analyze_image_with_sensitivity(const uint8_t* image_data, int width, int hei
 
 void cleanup_moderator();
 
+void set_image_cache_capacity(int capacity);
+
+void clear_image_cache();
+
+double get_image_cache_hits();
+
+double get_image_cache_misses();
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,133 @@
+#ifndef REPETITION_SKETCH_HPP
+#define REPETITION_SKETCH_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "result_cache.hpp"
+
+// Оценка повторов (флуд, "BUY NOW BUY NOW...", серии символов, одна и та же
+// ссылка) за один линейный проход. N-граммы слов и символов хешируются
+// скользящим хешем и считаются в count-min скетче фиксированного размера,
+// поэтому память не зависит от длины текста. Скетч сбрасывается каждые
+// kWindow n-грамм, чтобы на длинных текстах он не переполнялся коллизиями:
+// флуд всё равно повторяется локально. Сброс не очищает массив: у каждой
+// ячейки есть номер поколения, и ячейка из старого поколения читается как 0,
+// поэтому короткое сообщение трогает только свои ячейки.
+class RepetitionSketch {
+public:
+    static const int kDepth = 4;
+    static const int kWidthBits = 11;
+    static const int kWidth = 1 << kWidthBits;
+    static const int kCharGram = 8;
+    static const int kWindow = kWidth / 2;
+
+    // Возвращает оценку 0-100: доля повторившихся n-грамм слов или символов.
+    int score(const std::string& text) {
+        reset();
+
+        const uint64_t base = 0x100000001b3ull;
+        uint64_t base_pow = 1;
+        for (int i = 0; i < kCharGram; ++i) base_pow *= base;
+
+        uint64_t char_hash = 0;
+        int char_total = 0;
+        int char_repeated = 0;
+
+        uint64_t word_hash = 0;
+        uint64_t prev_word_hash = 0;
+        bool in_word = false;
+        bool has_prev_word = false;
+        int word_total = 0;
+        int word_repeated = 0;
+
+        for (size_t i = 0; i <= text.size(); ++i) {
+            bool at_end = i == text.size();
+            unsigned char c = at_end ? 0 : static_cast<unsigned char>(text[i]);
+
+            if (!at_end) {
+                char_hash = char_hash * base + c + 1;
+                if (i >= static_cast<size_t>(kCharGram)) {
+                    unsigned char out = static_cast<unsigned char>(text[i - kCharGram]);
+                    char_hash -= (out + 1) * base_pow;
+                }
+                if (i + 1 >= static_cast<size_t>(kCharGram)) {
+                    char_total++;
+                    if (add(char_hash) > 1) char_repeated++;
+                }
+            }
+
+            // Байты UTF-8 (>= 0x80) считаем частью слова, чтобы кириллица не дробилась
+            bool word_char = !at_end && (c >= 0x80 || std::isalnum(c));
+            if (word_char) {
+                word_hash = word_hash * base + c + 1;
+                in_word = true;
+            } else if (in_word) {
+                if (has_prev_word) {
+                    word_total++;
+                    uint64_t bigram = prev_word_hash * 0x9e3779b97f4a7c15ull ^ word_hash;
+                    if (add(bigram ^ 0xc2b2ae3d27d4eb4full) > 1) word_repeated++;
+                }
+                prev_word_hash = word_hash;
+                has_prev_word = true;
+                word_hash = 0;
+                in_word = false;
+            }
+        }
+
+        float word_ratio = word_total >= 3 ? static_cast<float>(word_repeated) / word_total : 0.0f;
+        float char_ratio = char_total >= kCharGram ? static_cast<float>(char_repeated) / char_total : 0.0f;
+
+        int result = static_cast<int>(std::max(word_ratio, char_ratio) * 100.0f + 0.5f);
+        return std::min(100, std::max(0, result));
+    }
+
+private:
+    void reset() {
+        window_items_ = 0;
+        if (++generation_ == 0) {
+            // Счётчик поколений переполнился — один раз очищаем всё честно
+            std::memset(generations_, 0, sizeof(generations_));
+            generation_ = 1;
+        }
+    }
+
+    // Консервативное обновление: увеличиваем только минимальные счётчики.
+    // Возвращает оценку частоты n-граммы с учётом текущего вхождения.
+    int add(uint64_t key) {
+        if (window_items_ == kWindow) reset();
+        window_items_++;
+
+        uint64_t h = cache_fmix(key);
+        uint16_t* cells[kDepth];
+        uint16_t min_count = UINT16_MAX;
+
+        for (int row = 0; row < kDepth; ++row) {
+            size_t col = (h >> (row * kWidthBits)) & (kWidth - 1);
+            if (generations_[row][col] != generation_) {
+                generations_[row][col] = generation_;
+                counters_[row][col] = 0;
+            }
+            cells[row] = &counters_[row][col];
+            min_count = std::min(min_count, *cells[row]);
+        }
+
+        if (min_count == UINT16_MAX) return min_count;
+
+        for (int row = 0; row < kDepth; ++row) {
+            if (*cells[row] == min_count) (*cells[row])++;
+        }
+        return min_count + 1;
+    }
+
+    uint16_t counters_[kDepth][kWidth] = {};
+    uint16_t generations_[kDepth][kWidth] = {};
+    uint16_t generation_ = 0;
+    int window_items_ = 0;
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+// Быстрый некриптографический хеш (в духе wyhash) по 8 байт за шаг.
+inline uint64_t cache_mix(uint64_t a, uint64_t b) {
+    __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+}
+
+inline uint64_t cache_fmix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+inline uint64_t cache_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Два независимых 64-битных хеша за один проход по данным: key — ключ
+// кэша, check — значение для проверки коллизий, хранится в записи.
+struct HashPair {
+    uint64_t key;
+    uint64_t check;
+};
+
+inline HashPair hash_bytes2(const void* data, size_t len, uint64_t seed = 0) {
+    const uint64_t k0 = 0xa0761d6478bd642full;
+    const uint64_t k1 = 0xe7037ed1a0b428dbull;
+    const uint64_t k2 = 0x8ebc6af09c88c6e3ull;
+    const uint64_t p1 = 0x9e3779b185ebca87ull;
+    const uint64_t p2 = 0xc2b2ae3d27d4eb4full;
+
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint64_t h = cache_fmix(seed ^ k0) ^ (static_cast<uint64_t>(len) * k1);
+    uint64_t c = cache_fmix(seed ^ p1) ^ (static_cast<uint64_t>(len) * p2);
+
+    // Результат умножения подмешивается к h, а не заменяет его: блок,
+    // обнуляющий произведение, не стирает длину, seed и предыдущие байты.
+    // Второй канал — раунд в духе xxh64 на обычном 64-битном умножении.
+    while (len >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        h ^= cache_mix(v ^ k1, h ^ k2);
+        c = cache_rotl(c + v * p2, 31) * p1;
+        p += 8;
+        len -= 8;
+    }
+
+    uint64_t tail = 0;
+    std::memcpy(&tail, p, len);
+    h ^= cache_mix(tail ^ k0, h ^ k2);
+    c = cache_rotl(c + tail * p2, 31) * p1;
+    return HashPair{ cache_fmix(h), cache_fmix(c) };
+}
+
+inline uint64_t hash_bytes(const void* data, size_t len, uint64_t seed = 0) {
+    return hash_bytes2(data, len, seed).key;
+}
+
+// Ограниченный LRU-кэш результатов по 64-битному ключу.
+// Вместе с результатом хранится Check (длина, размеры изображения,
+// второй хеш): при совпадении ключа, но разном Check запись считается
+// промахом, так что коллизия хеша не отдаёт чужой результат.
+// Ёмкость 0 отключает кэш.
+template <typename Check, typename Value>
+class ResultCache {
+public:
+    explicit ResultCache(size_t capacity) : capacity_(capacity) {}
+
+    bool enabled() const { return capacity_ > 0; }
+
+    bool get(uint64_t key, const Check& check, Value& value) {
+        if (capacity_ == 0) return false;
+
+        auto it = index_.find(key);
+        if (it == index_.end() || !(it->second->check == check)) {
+            misses_++;
+            return false;
+        }
+
+        entries_.splice(entries_.begin(), entries_, it->second);
+        value = it->second->value;
+        hits_++;
+        return true;
+    }
+
+    void put(uint64_t key, const Check& check, const Value& value) {
+        if (capacity_ == 0) return;
+
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->check = check;
+            it->second->value = value;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+
+        entries_.push_front(Entry{ key, check, value });
+        index_[key] = entries_.begin();
+        evict();
+    }
+
+    void clear() {
+        entries_.clear();
+        index_.clear();
+    }
+
+    void set_capacity(size_t capacity) {
+        capacity_ = capacity;
+        evict();
+    }
+
+    void reset_stats() {
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    size_t size() const { return entries_.size(); }
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+private:
+    struct Entry {
+        uint64_t key;
+        Check check;
+        Value value;
+    };
+
+    void evict() {
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+        }
+    }
+
+    size_t capacity_;
+    std::list<Entry> entries_;
+    std::unordered_map<uint64_t, typename std::list<Entry>::iterator> index_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+#endif
@@ -11,12 +11,18 @@ void init_text_filter();
 void load_bad_words(const char* words);
 int check_text(const char* text);
 int check_text_with_detail(const char* text, char* found_word);
+int check_text_with_score(const char* text, int* repetition_score);
 void add_bad_word(const char* word);
 void remove_bad_word(const char* word);
 void clear_bad_words();
 int get_bad_words_count();
 void cleanup_text_filter();
 
+void set_text_cache_capacity(int capacity);
+void clear_text_cache();
+double get_text_cache_hits();
+double get_text_cache_misses();
+
 #ifdef __cplusplus
 }
 #endif
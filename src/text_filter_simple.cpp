@@ -1,4 +1,6 @@
 #include "text_filter.hpp"
+#include "result_cache.hpp"
+#include "repetition_sketch.hpp"
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -10,6 +12,33 @@ namespace {
 std::vector<std::string> bad_words;
 bool is_initialized = false;
 
+struct TextResult {
+    int result = 0;
+    int repetition_score = 0;
+    bool has_score = false;
+    std::string found_word;
+};
+
+// Длина и второй хеш текста, хранятся в записи кэша вместо самого текста
+struct TextCheck {
+    size_t length = 0;
+    uint64_t text_hash = 0;
+
+    bool operator==(const TextCheck& other) const {
+        return length == other.length && text_hash == other.text_hash;
+    }
+};
+
+// Тексты длиннее лимита не кэшируются: копипаст-спам короткий, а длинные
+// вставки только вытесняли бы полезные записи
+const size_t kMaxCachedTextLength = 4096;
+
+// Кэш результатов проверки, ключ — хеш текста с версией словаря в качестве seed
+ResultCache<TextCheck, TextResult> text_cache(256);
+uint64_t dictionary_version = 0;
+
+RepetitionSketch repetition_sketch;
+
 std::string to_lower(const std::string& str) {
     std::string result = str;
     for (char& c : result) {
@@ -18,6 +47,57 @@ std::string to_lower(const std::string& str) {
     return result;
 }
 
+void on_dictionary_changed() {
+    dictionary_version++;
+    text_cache.clear();
+}
+
+TextResult find_bad_word(const char* text, bool with_score) {
+    std::string text_str(text);
+    bool cacheable = text_cache.enabled() && text_str.size() <= kMaxCachedTextLength;
+    uint64_t key = 0;
+    TextCheck check;
+    TextResult found;
+    bool cached = false;
+
+    if (cacheable) {
+        HashPair hash = hash_bytes2(text_str.data(), text_str.size(), dictionary_version);
+        key = hash.key;
+        check.length = text_str.size();
+        check.text_hash = hash.check;
+
+        cached = text_cache.get(key, check, found);
+        if (cached && (found.has_score || !with_score)) {
+            return found;
+        }
+    }
+
+    std::string text_lower = to_lower(text_str);
+
+    if (!cached) {
+        for (const std::string& bad_word : bad_words) {
+            if (text_lower.find(bad_word) != std::string::npos) {
+                found.result = 1;
+                found.found_word = bad_word;
+                break;
+            }
+        }
+    }
+
+    // Оценка повторов — отдельный линейный проход по тексту: словарь ищется
+    // через find() по каждому слову, общего побайтового цикла для n-грамм
+    // нет. Считаем её только по запросу, чтобы check_text не платил за неё.
+    if (with_score) {
+        found.repetition_score = repetition_sketch.score(text_lower);
+        found.has_score = true;
+    }
+
+    if (cacheable) {
+        text_cache.put(key, check, found);
+    }
+    return found;
+}
+
 }
 
 void init_text_filter() {
@@ -31,6 +111,7 @@ void init_text_filter() {
         bad_words.push_back(to_lower(word));
     }
 
+    on_dictionary_changed();
     is_initialized = true;
 }
 
@@ -40,21 +121,14 @@ void add_bad_word(const char* word) {
 
     if (std::find(bad_words.begin(), bad_words.end(), word_str) == bad_words.end()) {
         bad_words.push_back(word_str);
+        on_dictionary_changed();
     }
 }
 
 int check_text(const char* text) {
     if (!text || !is_initialized) return 0;
 
-    std::string text_lower = to_lower(text);
-
-    for (const std::string& bad_word : bad_words) {
-        if (text_lower.find(bad_word) != std::string::npos) {
-            return 1;
-        }
-    }
-
-    return 0;
+    return find_bad_word(text, false).result;
 }
 
 int get_bad_words_count() {
@@ -77,10 +151,13 @@ void load_bad_words(const char* words) {
             current_word += words_str[i];
         }
     }
+
+    on_dictionary_changed();
 }
 
 void clear_bad_words() {
     bad_words.clear();
+    on_dictionary_changed();
 }
 
 void remove_bad_word(const char* word) {
@@ -90,6 +167,7 @@ void remove_bad_word(const char* word) {
     for (auto it = bad_words.begin(); it != bad_words.end(); ) {
         if (*it == word_str) {
             it = bad_words.erase(it);
+            on_dictionary_changed();
         } else {
             ++it;
         }
@@ -99,21 +177,53 @@ void remove_bad_word(const char* word) {
 int check_text_with_detail(const char* text, char* found_word) {
     if (!text || !found_word || !is_initialized) return 0;
 
-    std::string text_lower = to_lower(text);
-
-    for (const std::string& bad_word : bad_words) {
-        if (text_lower.find(bad_word) != std::string::npos) {
-            std::strncpy(found_word, bad_word.c_str(), 63);
-            found_word[63] = '\0';
-            return 1;
-        }
+    TextResult found = find_bad_word(text, false);
+    if (found.result) {
+        std::strncpy(found_word, found.found_word.c_str(), 63);
+        found_word[63] = '\0';
+        return 1;
     }
 
     found_word[0] = '\0';
     return 0;
 }
 
+int check_text_with_score(const char* text, int* repetition_score) {
+    if (!repetition_score) return 0;
+    *repetition_score = 0;
+    if (!text) return 0;
+
+    // Оценка повторов не зависит от словаря, поэтому считается и до init
+    if (!is_initialized) {
+        *repetition_score = repetition_sketch.score(to_lower(text));
+        return 0;
+    }
+
+    TextResult found = find_bad_word(text, true);
+    *repetition_score = found.repetition_score;
+    return found.result;
+}
+
 void cleanup_text_filter() {
     bad_words.clear();
+    on_dictionary_changed();
+    text_cache.reset_stats();
     is_initialized = false;
 }
+
+void set_text_cache_capacity(int capacity) {
+    text_cache.set_capacity(static_cast<size_t>(std::max(0, capacity)));
+}
+
+void clear_text_cache() {
+    text_cache.clear();
+    text_cache.reset_stats();
+}
+
+double get_text_cache_hits() {
+    return static_cast<double>(text_cache.hits());
+}
+
+double get_text_cache_misses() {
+    return static_cast<double>(text_cache.misses());
+}
@@ -45,6 +45,48 @@ async function initApp() {
       "number",
       [],
     );
+    // Экспорт есть только в сборке compile_all.sh с кэшем результатов
+    if (typeof window.Module._set_text_cache_capacity === "function") {
+      window.set_text_cache_capacity = window.Module.cwrap(
+        "set_text_cache_capacity",
+        null,
+        ["number"],
+      );
+      window.clear_text_cache = window.Module.cwrap(
+        "clear_text_cache",
+        null,
+        [],
+      );
+      window.get_text_cache_hits = window.Module.cwrap(
+        "get_text_cache_hits",
+        "number",
+        [],
+      );
+      window.get_text_cache_misses = window.Module.cwrap(
+        "get_text_cache_misses",
+        "number",
+        [],
+      );
+    }
+    // Экспорт есть только в сборке compile_all.sh с check_text_with_score
+    if (typeof window.Module._check_text_with_score === "function") {
+      window.check_text_with_score = window.Module.cwrap(
+        "check_text_with_score",
+        "number",
+        ["string", "number"],
+      );
+      window.checkTextWithScore = (text) => {
+        const scorePtr = window.Module._malloc(4);
+        try {
+          window.Module.HEAP32[scorePtr >> 2] = 0;
+          const result = window.check_text_with_score(text, scorePtr);
+          const repetitionScore = window.Module.HEAP32[scorePtr >> 2];
+          return { result, repetitionScore };
+        } finally {
+          window.Module._free(scorePtr);
+        }
+      };
+    }
 
     // Инициализируем фильтр
     window.init_text_filter();
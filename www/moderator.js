@@ -129,6 +129,29 @@ async function initModerator() {
       "number",
       ["number", "number", "number", "number"],
     );
+    // Экспорт есть только в сборке compile_all.sh с кэшем результатов
+    if (typeof moderatorModule._set_image_cache_capacity === "function") {
+      window.set_image_cache_capacity = moderatorModule.cwrap(
+        "set_image_cache_capacity",
+        null,
+        ["number"],
+      );
+      window.clear_image_cache = moderatorModule.cwrap(
+        "clear_image_cache",
+        null,
+        [],
+      );
+      window.get_image_cache_hits = moderatorModule.cwrap(
+        "get_image_cache_hits",
+        "number",
+        [],
+      );
+      window.get_image_cache_misses = moderatorModule.cwrap(
+        "get_image_cache_misses",
+        "number",
+        [],
+      );
+    }
 
     console.log("✅ Функции C++ обернуты");
 